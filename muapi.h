@@ -126,6 +126,9 @@ typedef uintptr_t MuArraySize;
 // Watch point ID
 typedef uint32_t MuWPID;
 
+// Identifies an asynchronous bundle loading operation
+typedef uint64_t MuLoadTicket;
+
 // Super type for numerical flags used by Mu.
 typedef uint32_t MuFlag;
 
@@ -136,6 +139,7 @@ typedef MuFlag MuTrapHandlerResult;
 #define MU_THREAD_EXIT          ((MuTrapHandlerResult)0x00)
 #define MU_REBIND_PASS_VALUES   ((MuTrapHandlerResult)0x01)
 #define MU_REBIND_THROW_EXC     ((MuTrapHandlerResult)0x02)
+#define MU_RESUME               ((MuTrapHandlerResult)0x03)
 
 // Used by MuTrapHandler
 typedef void _MuValuesFreer_Func(MuValue *values, MuCPtr freerdata);
@@ -195,6 +199,13 @@ typedef MuFlag MuBinOptr;
 #define MU_BINOP_FDIV   ((MuBinOptr)0xB3)
 #define MU_BINOP_FREM   ((MuBinOptr)0xB4)
 
+// Status flags of binary operations
+typedef MuFlag MuBinOpStatus;
+#define MU_BINOP_STATUS_N   ((MuBinOpStatus)0x01)
+#define MU_BINOP_STATUS_Z   ((MuBinOpStatus)0x02)
+#define MU_BINOP_STATUS_C   ((MuBinOpStatus)0x04)
+#define MU_BINOP_STATUS_V   ((MuBinOpStatus)0x08)
+
 // Comparing operators
 typedef MuFlag MuCmpOptr;
 #define MU_CMP_EQ       ((MuCmpOptr)0x20)
@@ -266,11 +277,113 @@ typedef MuFlag MuAtomicRMWOptr;
 // Calling conventions.
 typedef MuFlag MuCallConv;
 #define MU_CC_DEFAULT   ((MuCallConv)0x00)
+#define MU_CC_LEAF      ((MuCallConv)0x01)
 // Concrete Mu implementations may define more calling conventions.
 
+// Modes of file-backed hybrids, used by new_hybrid_from_file
+typedef MuFlag MuMapMode;
+#define MU_MAP_READONLY ((MuMapMode)0x01)
+#define MU_MAP_PRIVATE  ((MuMapMode)0x02)
+
+// Indices of the statistics written by get_alloc_stats
+typedef MuFlag MuAllocStat;
+#define MU_ALLOC_STAT_OBJECTS       ((MuAllocStat)0x00)
+#define MU_ALLOC_STAT_BYTES         ((MuAllocStat)0x01)
+#define MU_ALLOC_STAT_POOL_REFILLS  ((MuAllocStat)0x02)
+#define MU_ALLOC_STAT_POOL_SIZE     ((MuAllocStat)0x03)
+#define MU_ALLOC_STAT_POOL_FREE     ((MuAllocStat)0x04)
+#define MU_ALLOC_STAT_SLOW_ALLOCS   ((MuAllocStat)0x05)
+
+// Indices of the statistics written by get_heap_stats
+typedef MuFlag MuHeapStat;
+#define MU_HEAP_STAT_HEAP_SIZE          ((MuHeapStat)0x00)
+#define MU_HEAP_STAT_HEAP_USED          ((MuHeapStat)0x01)
+#define MU_HEAP_STAT_YOUNG_USED         ((MuHeapStat)0x02)
+#define MU_HEAP_STAT_OLD_USED           ((MuHeapStat)0x03)
+#define MU_HEAP_STAT_BYTES_ALLOCATED    ((MuHeapStat)0x04)
+#define MU_HEAP_STAT_BYTES_PROMOTED     ((MuHeapStat)0x05)
+#define MU_HEAP_STAT_ALLOC_RATE         ((MuHeapStat)0x06)
+#define MU_HEAP_STAT_MINOR_GCS          ((MuHeapStat)0x07)
+#define MU_HEAP_STAT_MAJOR_GCS          ((MuHeapStat)0x08)
+#define MU_HEAP_STAT_TOTAL_PAUSE_NS     ((MuHeapStat)0x09)
+#define MU_HEAP_STAT_MAX_PAUSE_NS       ((MuHeapStat)0x0A)
+#define MU_HEAP_STAT_LARGE_OBJECTS      ((MuHeapStat)0x0B)
+#define MU_HEAP_STAT_LARGE_USED         ((MuHeapStat)0x0C)
+#define MU_HEAP_STAT_LARGE_MAPPED       ((MuHeapStat)0x0D)
+#define MU_HEAP_STAT_HUGE_PAGE_BYTES    ((MuHeapStat)0x0E)
+#define MU_HEAP_STAT_LARGE_RELEASED     ((MuHeapStat)0x0F)
+
+// Kinds of garbage collection, used by get_gc_pause_histogram
+typedef MuFlag MuGCKind;
+#define MU_GC_MINOR     ((MuGCKind)0x01)
+#define MU_GC_MAJOR     ((MuGCKind)0x02)
+
+// Flags for set_large_alloc_policy
+typedef MuFlag MuLargeAllocFlags;
+#define MU_LARGE_ALLOC_HUGE_PAGES   ((MuLargeAllocFlags)0x01)
+#define MU_LARGE_ALLOC_RELEASE      ((MuLargeAllocFlags)0x02)
+
+// Flags for enable_perf_maps
+typedef MuFlag MuPerfMapFlags;
+#define MU_PERF_MAP         ((MuPerfMapFlags)0x01)
+#define MU_PERF_JITDUMP     ((MuPerfMapFlags)0x02)
+
 // Common instructions.
 typedef MuFlag MuCommInst;
 
+// Words and record kinds of IR builder instruction streams.
+// Each record kind mirrors the IR Builder API function of the same name.
+typedef uint32_t MuIRStreamWord;
+typedef MuFlag MuIRStreamOp;
+#define MU_IRS_NEW_BB                   ((MuIRStreamOp)0x01)
+#define MU_IRS_NEW_NOR_PARAM            ((MuIRStreamOp)0x02)
+#define MU_IRS_NEW_EXC_PARAM            ((MuIRStreamOp)0x03)
+#define MU_IRS_NEW_INST_RES             ((MuIRStreamOp)0x04)
+#define MU_IRS_ADD_DEST                 ((MuIRStreamOp)0x05)
+#define MU_IRS_ADD_KEEPALIVES           ((MuIRStreamOp)0x06)
+#define MU_IRS_NEW_BINOP                ((MuIRStreamOp)0x10)
+#define MU_IRS_NEW_CMP                  ((MuIRStreamOp)0x11)
+#define MU_IRS_NEW_CONV                 ((MuIRStreamOp)0x12)
+#define MU_IRS_NEW_SELECT               ((MuIRStreamOp)0x13)
+#define MU_IRS_NEW_BRANCH               ((MuIRStreamOp)0x14)
+#define MU_IRS_NEW_BRANCH2              ((MuIRStreamOp)0x15)
+#define MU_IRS_NEW_SWITCH               ((MuIRStreamOp)0x16)
+#define MU_IRS_ADD_SWITCH_DEST          ((MuIRStreamOp)0x17)
+#define MU_IRS_NEW_CALL                 ((MuIRStreamOp)0x18)
+#define MU_IRS_NEW_TAILCALL             ((MuIRStreamOp)0x19)
+#define MU_IRS_NEW_RET                  ((MuIRStreamOp)0x1A)
+#define MU_IRS_NEW_THROW                ((MuIRStreamOp)0x1B)
+#define MU_IRS_NEW_EXTRACTVALUE         ((MuIRStreamOp)0x1C)
+#define MU_IRS_NEW_INSERTVALUE          ((MuIRStreamOp)0x1D)
+#define MU_IRS_NEW_EXTRACTELEMENT       ((MuIRStreamOp)0x1E)
+#define MU_IRS_NEW_INSERTELEMENT        ((MuIRStreamOp)0x1F)
+#define MU_IRS_NEW_SHUFFLEVECTOR        ((MuIRStreamOp)0x20)
+#define MU_IRS_NEW_NEW                  ((MuIRStreamOp)0x21)
+#define MU_IRS_NEW_NEWHYBRID            ((MuIRStreamOp)0x22)
+#define MU_IRS_NEW_ALLOCA               ((MuIRStreamOp)0x23)
+#define MU_IRS_NEW_ALLOCAHYBRID         ((MuIRStreamOp)0x24)
+#define MU_IRS_NEW_GETIREF              ((MuIRStreamOp)0x25)
+#define MU_IRS_NEW_GETFIELDIREF         ((MuIRStreamOp)0x26)
+#define MU_IRS_NEW_GETELEMIREF          ((MuIRStreamOp)0x27)
+#define MU_IRS_NEW_SHIFTIREF            ((MuIRStreamOp)0x28)
+#define MU_IRS_NEW_GETVARPARTIREF       ((MuIRStreamOp)0x29)
+#define MU_IRS_NEW_LOAD                 ((MuIRStreamOp)0x2A)
+#define MU_IRS_NEW_STORE                ((MuIRStreamOp)0x2B)
+#define MU_IRS_NEW_CMPXCHG              ((MuIRStreamOp)0x2C)
+#define MU_IRS_NEW_ATOMICRMW            ((MuIRStreamOp)0x2D)
+#define MU_IRS_NEW_FENCE                ((MuIRStreamOp)0x2E)
+#define MU_IRS_NEW_TRAP                 ((MuIRStreamOp)0x2F)
+#define MU_IRS_NEW_WATCHPOINT           ((MuIRStreamOp)0x30)
+#define MU_IRS_NEW_WPBRANCH             ((MuIRStreamOp)0x31)
+#define MU_IRS_NEW_CCALL                ((MuIRStreamOp)0x32)
+#define MU_IRS_NEW_NEWTHREAD            ((MuIRStreamOp)0x33)
+#define MU_IRS_NEW_SWAPSTACK_RET        ((MuIRStreamOp)0x34)
+#define MU_IRS_NEW_SWAPSTACK_KILL       ((MuIRStreamOp)0x35)
+#define MU_IRS_SET_NEWSTACK_PASS_VALUES ((MuIRStreamOp)0x36)
+#define MU_IRS_SET_NEWSTACK_THROW_EXC   ((MuIRStreamOp)0x37)
+#define MU_IRS_NEW_COMMINST             ((MuIRStreamOp)0x38)
+#define MU_IRS_NEW_BINOP_WITH_STATUS    ((MuIRStreamOp)0x39)
+
 // NOTE: MuVM and MuCtx are structures with many function pointers. This
 // approach loosens the coupling between the client module and the Mu
 // implementation.  At compile time, the client does not need to link against
@@ -287,9 +400,46 @@ struct MuVM {
     // Convert between IDs and names. Cannot be used on the bundles being built.
     MuID    (*id_of  )(MuVM *mvm, MuName name);
     MuName  (*name_of)(MuVM *mvm, MuID id);
+    void    (*ids_of )(MuVM *mvm, MuName *names, MuID *ids, MuArraySize n); /// MUAPIPARSER names:array:n;ids:array:n;ids:out
 
     // Set handlers
     void    (*set_trap_handler      )(MuVM *mvm, MuTrapHandler trap_handler, MuCPtr userdata);
+    void    (*set_wp_trap_handler   )(MuVM *mvm, MuWPID wpid, MuTrapHandler trap_handler, MuCPtr userdata); /// MUAPIPARSER trap_handler:optional
+    void    (*set_inst_trap_handler )(MuVM *mvm, MuID inst, MuTrapHandler trap_handler, MuCPtr userdata); /// MUAPIPARSER trap_handler:optional
+    void    (*set_hotness_handler   )(MuVM *mvm, MuTrapHandler hotness_handler, uint64_t call_threshold, uint64_t backedge_threshold, MuCPtr userdata); /// MUAPIPARSER hotness_handler:optional
+
+    // Execution counters of function versions
+    MuBool  (*get_exec_counters  )(MuVM *mvm, MuID func_ver, uint64_t *calls, uint64_t *backedges); /// MUAPIPARSER calls:out;backedges:out
+    void    (*reset_exec_counters)(MuVM *mvm, MuID func_ver);
+
+    // Compiled bundle cache
+    void    (*set_bundle_cache)(MuVM *mvm, MuName dir); /// MUAPIPARSER dir:optional
+
+    // Scheduler statistics
+    MuArraySize (*get_sched_stats)(MuVM *mvm, uint64_t *qdepths, uint64_t *nsteals, MuArraySize sz); /// MUAPIPARSER qdepths:array:sz;qdepths:out;nsteals:array:sz;nsteals:out
+
+    // Heap and garbage collection statistics
+    void        (*get_heap_stats        )(MuVM *mvm, uint64_t *stats, MuArraySize nstats); /// MUAPIPARSER stats:array:nstats;stats:out
+    uint64_t    (*get_gc_pause_histogram)(MuVM *mvm, MuGCKind kind, uint64_t *counts, MuArraySize nbuckets); /// MUAPIPARSER counts:array:nbuckets;counts:out
+
+    // Large object allocation
+    void        (*set_large_alloc_policy)(MuVM *mvm, uint64_t threshold, MuLargeAllocFlags flags);
+
+    // Sampling profiler
+    MuBool      (*start_profiler      )(MuVM *mvm, uint64_t interval_ns, MuArraySize buf_words);
+    void        (*stop_profiler       )(MuVM *mvm);
+    MuArraySize (*read_profile_samples)(MuVM *mvm, MuID *words, MuArraySize nwords); /// MUAPIPARSER words:array:nwords;words:out
+    uint64_t    (*get_profile_dropped )(MuVM *mvm);
+
+    // Symbol information for external profilers
+    void        (*enable_perf_maps)(MuVM *mvm, MuPerfMapFlags flags);
+
+    // Attach native threads for calling exposed Mu functions
+    MuBool      (*attach_current_thread)(MuVM *mvm, MuArraySize stack_size);
+    void        (*detach_current_thread)(MuVM *mvm);
+
+    // Query whether atomic operations on a type are lock-free
+    MuBool      (*is_lock_free)(MuVM *mvm, MuID type, MuMemOrd ord);
 };
 
 // A local context. It can only be used by one thread at a time. It holds many
@@ -303,6 +453,7 @@ struct MuCtx {
     // Convert between IDs and names. Cannot be used on the bundles being built.
     MuID        (*id_of  )(MuCtx *ctx, MuName name);
     MuName      (*name_of)(MuCtx *ctx, MuID id);
+    void        (*ids_of )(MuCtx *ctx, MuName *names, MuID *ids, MuArraySize n); /// MUAPIPARSER names:array:n;ids:array:n;ids:out
 
     // Close the current context, releasing all resources
     void        (*close_context)(MuCtx *ctx);
@@ -311,6 +462,16 @@ struct MuCtx {
     void        (*load_bundle)(MuCtx *ctx, char *buf, MuArraySize sz); /// MUAPIPARSER buf:array:sz
     void        (*load_hail  )(MuCtx *ctx, char *buf, MuArraySize sz); /// MUAPIPARSER buf:array:sz
 
+    // Load bundles asynchronously. Function versions are compiled and
+    // published in the background.
+    MuLoadTicket    (*load_bundle_async)(MuCtx *ctx, char *buf, MuArraySize sz); /// MUAPIPARSER buf:array:sz
+    MuBool          (*poll_load        )(MuCtx *ctx, MuLoadTicket ticket);
+    void            (*wait_load        )(MuCtx *ctx, MuLoadTicket ticket);
+
+    // Save and load heap images
+    MuBool      (*save_heap_image)(MuCtx *ctx, MuName path, MuRefValue *roots, MuArraySize nroots, MuID *globals, MuArraySize nglobals); /// MUAPIPARSER roots:array:nroots;globals:array:nglobals
+    MuBool      (*load_heap_image)(MuCtx *ctx, MuName path, MuRefValue *roots, MuArraySize nroots); /// MUAPIPARSER roots:array:nroots;roots:out
+
     // Convert from C values to Mu values
     MuIntValue      (*handle_from_sint8  )(MuCtx *ctx, int8_t     num, int len);
     MuIntValue      (*handle_from_uint8  )(MuCtx *ctx, uint8_t    num, int len);
@@ -350,6 +511,12 @@ struct MuCtx {
     // the resource.
     void        (*delete_value)(MuCtx *ctx, MuValue opnd);
 
+    // Handle scopes. Popping a scope deletes all values created in it at once.
+    void        (*push_handle_scope)(MuCtx *ctx);
+    void        (*pop_handle_scope )(MuCtx *ctx);
+    // Copy a value into the enclosing scope so that it survives the next pop.
+    MuValue     (*promote_value    )(MuCtx *ctx, MuValue opnd);
+
     // Compare reference or general reference types.
     // EQ. Available for ref, iref, funcref, threadref and stackref.
     MuBool      (*ref_eq )(MuCtx *ctx, MuGenRefValue lhs, MuGenRefValue rhs);
@@ -369,6 +536,16 @@ struct MuCtx {
     MuRefValue  (*new_fixed )(MuCtx *ctx, MuID mu_type);
     MuRefValue  (*new_hybrid)(MuCtx *ctx, MuID mu_type, MuIntValue length);
 
+    // Bulk heap allocation. References are stored into memory, not returned as handles.
+    MuArraySize (*new_fixed_many )(MuCtx *ctx, MuID mu_type, MuArraySize n, MuIRefValue dst);
+    MuArraySize (*new_hybrid_many)(MuCtx *ctx, MuID mu_type, uint64_t *lengths, MuArraySize n, MuIRefValue dst); /// MUAPIPARSER lengths:array:n
+
+    // Allocate a hybrid whose variable part is a mapped region of a file
+    MuRefValue  (*new_hybrid_from_file)(MuCtx *ctx, MuID mu_type, MuName path, uint64_t offset, uint64_t length, MuMapMode mode);
+
+    // Statistics of the local allocation pool of this context
+    void        (*get_alloc_stats)(MuCtx *ctx, uint64_t *stats, MuArraySize nstats); /// MUAPIPARSER stats:array:nstats;stats:out
+
     // Change the T or sig in ref<T>, iref<T> or func<sig>
     MuGenRefValue   (*refcast)(MuCtx *ctx, MuGenRefValue opnd, MuID new_type);
 
@@ -389,11 +566,16 @@ struct MuCtx {
                         MuIRefValue loc, MuValue opnd);
     void        (*fence    )(MuCtx *ctx, MuMemOrd ord);
 
+    // Bulk memory accessing between Mu memory arrays and C buffers
+    void        (*load_bulk )(MuCtx *ctx, MuIRefValue loc, MuCPtr buf, MuArraySize nelems);
+    void        (*store_bulk)(MuCtx *ctx, MuIRefValue loc, MuCPtr buf, MuArraySize nelems);
+
     // Thread and stack creation and stack destruction
     MuStackRefValue     (*new_stack )(MuCtx *ctx, MuFuncRefValue func);
+    MuStackRefValue     (*new_stack_sized)(MuCtx *ctx, MuFuncRefValue func, MuArraySize size_hint);
     MuThreadRefValue    (*new_thread_nor)(MuCtx *ctx, MuStackRefValue stack,
                             MuRefValue threadlocal,
-                            MuValue *vals, MuBool nvals); /// MUAPIPARSER threadlocal:optional;vals:array:nvals
+                            MuValue *vals, MuArraySize nvals); /// MUAPIPARSER threadlocal:optional;vals:array:nvals
     MuThreadRefValue    (*new_thread_exc)(MuCtx *ctx, MuStackRefValue stack,
                             MuRefValue threadlocal,
                             MuRefValue exc); /// MUAPIPARSER threadlocal:optional
@@ -415,6 +597,10 @@ struct MuCtx {
     MuID        (*cur_func_ver   )(MuCtx *ctx, MuFCRefValue cursor);
     MuID        (*cur_inst       )(MuCtx *ctx, MuFCRefValue cursor);
     void        (*dump_keepalives)(MuCtx *ctx, MuFCRefValue cursor, MuValue *results); /// MUAPIPARSER results:out
+    MuArraySize (*snapshot_stack )(MuCtx *ctx, MuStackRefValue stack, MuArraySize nframes,
+                    MuID *funcs, MuID *func_vers, MuID *insts,
+                    MuValue *keepalives, MuArraySize nkeepalives,
+                    MuBool *reached_bottom); /// MUAPIPARSER funcs:array:nframes;funcs:out;func_vers:array:nframes;func_vers:out;insts:array:nframes;insts:out;keepalives:array:nkeepalives;keepalives:out;keepalives:optional;reached_bottom:out;reached_bottom:optional
     
     // On-stack replacement
     void        (*pop_frames_to)(MuCtx *ctx, MuFCRefValue cursor);
@@ -440,6 +626,13 @@ struct MuCtx {
     MuUPtrValue (*pin  )(MuCtx *ctx, MuValue loc);      // loc is either MuRefValue or MuIRefValue
     void        (*unpin)(MuCtx *ctx, MuValue loc);      // loc is either MuRefValue or MuIRefValue
 
+    // Pin and unpin many locations at once. Each element of locs is either MuRefValue or MuIRefValue.
+    void        (*pin_many  )(MuCtx *ctx, MuValue *locs, MuArraySize n, uintptr_t *addrs); /// MUAPIPARSER locs:array:n;addrs:array:n;addrs:optional;addrs:out
+    void        (*unpin_many)(MuCtx *ctx, MuValue *locs, MuArraySize n); /// MUAPIPARSER locs:array:n
+
+    // Allocate a hybrid which is never moved by the garbage collector
+    MuRefValue  (*new_hybrid_nonmoving)(MuCtx *ctx, MuID mu_type, MuIntValue length);
+
     // Expose Mu functions as native callable things, usually function pointers
     MuValue     (*expose  )(MuCtx *ctx, MuFuncRefValue func, MuCallConv call_conv, MuIntValue cookie);
     void        (*unexpose)(MuCtx *ctx, MuCallConv call_conv, MuValue value);
@@ -451,6 +644,8 @@ struct MuCtx {
 
     // Load a bundle built from an IR Builder into the micro VM
     void        (*load_bundle_from_node )(MuCtx *ctx, MuBundleNode b);
+    // Asynchronous version. See load_bundle_async.
+    MuLoadTicket (*load_bundle_from_node_async)(MuCtx *ctx, MuBundleNode b);
     // Call this function before the node is loaded to release all of its resources.
     void        (*abort_bundle_node     )(MuCtx *ctx, MuBundleNode b);
 
@@ -559,6 +754,7 @@ struct MuCtx {
     /// Create instructions. Instructions are appended to the basic block "bb".
 
     MuInstNode  (*new_binop         )(MuCtx *ctx, MuBBNode bb, MuBinOptr  optr,    MuTypeNode ty,      MuVarNode  opnd1, MuVarNode opnd2);
+    MuInstNode  (*new_binop_with_status)(MuCtx *ctx, MuBBNode bb, MuBinOptr optr, MuBinOpStatus status_flags, MuTypeNode ty, MuVarNode opnd1, MuVarNode opnd2);
     MuInstNode  (*new_cmp           )(MuCtx *ctx, MuBBNode bb, MuCmpOptr  optr,    MuTypeNode ty,      MuVarNode  opnd1, MuVarNode opnd2);
     MuInstNode  (*new_conv          )(MuCtx *ctx, MuBBNode bb, MuConvOptr optr,    MuTypeNode from_ty, MuTypeNode to_ty, MuVarNode opnd);
     MuInstNode  (*new_select        )(MuCtx *ctx, MuBBNode bb, MuTypeNode cond_ty, MuTypeNode opnd_ty, MuVarNode  cond,  MuVarNode if_true, MuVarNode if_false);
@@ -615,53 +811,84 @@ struct MuCtx {
                                         MuFuncSigNode *sigs,  MuArraySize nsigs,
                                         MuVarNode     *args,  MuArraySize nargs);
                  /// MUAPIPARSER flags:array:nflags;tys:array:ntys;sigs:array:nsigs;args:array:nargs
+
+    // Create a function version and its whole CFG from an instruction stream
+    // in one call. Operands in the stream are indices into a node table.
+    MuFuncVerNode   (*new_func_ver_from_stream)(MuCtx *ctx, MuBundleNode b, MuFuncNode func,
+                                        MuIRNode       *externs, MuArraySize nexterns,
+                                        MuIRStreamWord *words,   MuArraySize nwords,
+                                        MuID *ids);
+                    /// MUAPIPARSER externs:array:nexterns;words:array:nwords;ids:optional;ids:out
 };
 
 // Common instruction opcodes
 /// SCRIPT: GENERATED COMMINSTS BEGIN
-#define MU_CI_UVM_NEW_STACK               ((MuCommInst)0x201)
-#define MU_CI_UVM_KILL_STACK              ((MuCommInst)0x202)
-#define MU_CI_UVM_THREAD_EXIT             ((MuCommInst)0x203)
-#define MU_CI_UVM_CURRENT_STACK           ((MuCommInst)0x204)
-#define MU_CI_UVM_SET_THREADLOCAL         ((MuCommInst)0x205)
-#define MU_CI_UVM_GET_THREADLOCAL         ((MuCommInst)0x206)
-#define MU_CI_UVM_TR64_IS_FP              ((MuCommInst)0x211)
-#define MU_CI_UVM_TR64_IS_INT             ((MuCommInst)0x212)
-#define MU_CI_UVM_TR64_IS_REF             ((MuCommInst)0x213)
-#define MU_CI_UVM_TR64_FROM_FP            ((MuCommInst)0x214)
-#define MU_CI_UVM_TR64_FROM_INT           ((MuCommInst)0x215)
-#define MU_CI_UVM_TR64_FROM_REF           ((MuCommInst)0x216)
-#define MU_CI_UVM_TR64_TO_FP              ((MuCommInst)0x217)
-#define MU_CI_UVM_TR64_TO_INT             ((MuCommInst)0x218)
-#define MU_CI_UVM_TR64_TO_REF             ((MuCommInst)0x219)
-#define MU_CI_UVM_TR64_TO_TAG             ((MuCommInst)0x21A)
-#define MU_CI_UVM_FUTEX_WAIT              ((MuCommInst)0x220)
-#define MU_CI_UVM_FUTEX_WAIT_TIMEOUT      ((MuCommInst)0x221)
-#define MU_CI_UVM_FUTEX_WAKE              ((MuCommInst)0x222)
-#define MU_CI_UVM_FUTEX_CMP_REQUEUE       ((MuCommInst)0x223)
-#define MU_CI_UVM_KILL_DEPENDENCY         ((MuCommInst)0x230)
-#define MU_CI_UVM_NATIVE_PIN              ((MuCommInst)0x240)
-#define MU_CI_UVM_NATIVE_UNPIN            ((MuCommInst)0x241)
-#define MU_CI_UVM_NATIVE_EXPOSE           ((MuCommInst)0x242)
-#define MU_CI_UVM_NATIVE_UNEXPOSE         ((MuCommInst)0x243)
-#define MU_CI_UVM_NATIVE_GET_COOKIE       ((MuCommInst)0x244)
-#define MU_CI_UVM_META_ID_OF              ((MuCommInst)0x250)
-#define MU_CI_UVM_META_NAME_OF            ((MuCommInst)0x251)
-#define MU_CI_UVM_META_LOAD_BUNDLE        ((MuCommInst)0x252)
-#define MU_CI_UVM_META_LOAD_HAIL          ((MuCommInst)0x253)
-#define MU_CI_UVM_META_NEW_CURSOR         ((MuCommInst)0x254)
-#define MU_CI_UVM_META_NEXT_FRAME         ((MuCommInst)0x255)
-#define MU_CI_UVM_META_COPY_CURSOR        ((MuCommInst)0x256)
-#define MU_CI_UVM_META_CLOSE_CURSOR       ((MuCommInst)0x257)
-#define MU_CI_UVM_META_CUR_FUNC           ((MuCommInst)0x258)
-#define MU_CI_UVM_META_CUR_FUNC_VER       ((MuCommInst)0x259)
-#define MU_CI_UVM_META_CUR_INST           ((MuCommInst)0x25A)
-#define MU_CI_UVM_META_DUMP_KEEPALIVES    ((MuCommInst)0x25B)
-#define MU_CI_UVM_META_POP_FRAMES_TO      ((MuCommInst)0x25C)
-#define MU_CI_UVM_META_PUSH_FRAME         ((MuCommInst)0x25D)
-#define MU_CI_UVM_META_ENABLE_WATCHPOINT  ((MuCommInst)0x25E)
-#define MU_CI_UVM_META_DISABLE_WATCHPOINT ((MuCommInst)0x25F)
-#define MU_CI_UVM_META_SET_TRAP_HANDLER   ((MuCommInst)0x260)
+#define MU_CI_UVM_NEW_STACK                   ((MuCommInst)0x201)
+#define MU_CI_UVM_KILL_STACK                  ((MuCommInst)0x202)
+#define MU_CI_UVM_THREAD_EXIT                 ((MuCommInst)0x203)
+#define MU_CI_UVM_CURRENT_STACK               ((MuCommInst)0x204)
+#define MU_CI_UVM_SET_THREADLOCAL             ((MuCommInst)0x205)
+#define MU_CI_UVM_GET_THREADLOCAL             ((MuCommInst)0x206)
+#define MU_CI_UVM_NEW_STACK_SIZED             ((MuCommInst)0x207)
+#define MU_CI_UVM_TR64_IS_FP                  ((MuCommInst)0x211)
+#define MU_CI_UVM_TR64_IS_INT                 ((MuCommInst)0x212)
+#define MU_CI_UVM_TR64_IS_REF                 ((MuCommInst)0x213)
+#define MU_CI_UVM_TR64_FROM_FP                ((MuCommInst)0x214)
+#define MU_CI_UVM_TR64_FROM_INT               ((MuCommInst)0x215)
+#define MU_CI_UVM_TR64_FROM_REF               ((MuCommInst)0x216)
+#define MU_CI_UVM_TR64_TO_FP                  ((MuCommInst)0x217)
+#define MU_CI_UVM_TR64_TO_INT                 ((MuCommInst)0x218)
+#define MU_CI_UVM_TR64_TO_REF                 ((MuCommInst)0x219)
+#define MU_CI_UVM_TR64_TO_TAG                 ((MuCommInst)0x21A)
+#define MU_CI_UVM_CHECKED_SADD                ((MuCommInst)0x280)
+#define MU_CI_UVM_CHECKED_SSUB                ((MuCommInst)0x281)
+#define MU_CI_UVM_CHECKED_SMUL                ((MuCommInst)0x282)
+#define MU_CI_UVM_CHECKED_UADD                ((MuCommInst)0x283)
+#define MU_CI_UVM_CHECKED_USUB                ((MuCommInst)0x284)
+#define MU_CI_UVM_CHECKED_UMUL                ((MuCommInst)0x285)
+#define MU_CI_UVM_MATH_SQRT                   ((MuCommInst)0x270)
+#define MU_CI_UVM_MATH_FMA                    ((MuCommInst)0x271)
+#define MU_CI_UVM_MATH_MIN                    ((MuCommInst)0x272)
+#define MU_CI_UVM_MATH_MAX                    ((MuCommInst)0x273)
+#define MU_CI_UVM_MATH_ABS                    ((MuCommInst)0x274)
+#define MU_CI_UVM_MATH_FLOOR                  ((MuCommInst)0x275)
+#define MU_CI_UVM_MATH_CEIL                   ((MuCommInst)0x276)
+#define MU_CI_UVM_MATH_EXP                    ((MuCommInst)0x277)
+#define MU_CI_UVM_MATH_LOG                    ((MuCommInst)0x278)
+#define MU_CI_UVM_MATH_SIN                    ((MuCommInst)0x279)
+#define MU_CI_UVM_MATH_COS                    ((MuCommInst)0x27A)
+#define MU_CI_UVM_FUTEX_WAIT                  ((MuCommInst)0x220)
+#define MU_CI_UVM_FUTEX_WAIT_TIMEOUT          ((MuCommInst)0x221)
+#define MU_CI_UVM_FUTEX_WAKE                  ((MuCommInst)0x222)
+#define MU_CI_UVM_FUTEX_CMP_REQUEUE           ((MuCommInst)0x223)
+#define MU_CI_UVM_FUTEX_WAIT_ANY              ((MuCommInst)0x224)
+#define MU_CI_UVM_KILL_DEPENDENCY             ((MuCommInst)0x230)
+#define MU_CI_UVM_NATIVE_PIN                  ((MuCommInst)0x240)
+#define MU_CI_UVM_NATIVE_UNPIN                ((MuCommInst)0x241)
+#define MU_CI_UVM_NATIVE_PIN_MANY             ((MuCommInst)0x245)
+#define MU_CI_UVM_NATIVE_UNPIN_MANY           ((MuCommInst)0x246)
+#define MU_CI_UVM_NATIVE_NEW_HYBRID_NONMOVING ((MuCommInst)0x247)
+#define MU_CI_UVM_NATIVE_EXPOSE               ((MuCommInst)0x242)
+#define MU_CI_UVM_NATIVE_UNEXPOSE             ((MuCommInst)0x243)
+#define MU_CI_UVM_NATIVE_GET_COOKIE           ((MuCommInst)0x244)
+#define MU_CI_UVM_META_ID_OF                  ((MuCommInst)0x250)
+#define MU_CI_UVM_META_NAME_OF                ((MuCommInst)0x251)
+#define MU_CI_UVM_META_LOAD_BUNDLE            ((MuCommInst)0x252)
+#define MU_CI_UVM_META_LOAD_HAIL              ((MuCommInst)0x253)
+#define MU_CI_UVM_META_NEW_CURSOR             ((MuCommInst)0x254)
+#define MU_CI_UVM_META_NEXT_FRAME             ((MuCommInst)0x255)
+#define MU_CI_UVM_META_COPY_CURSOR            ((MuCommInst)0x256)
+#define MU_CI_UVM_META_CLOSE_CURSOR           ((MuCommInst)0x257)
+#define MU_CI_UVM_META_CUR_FUNC               ((MuCommInst)0x258)
+#define MU_CI_UVM_META_CUR_FUNC_VER           ((MuCommInst)0x259)
+#define MU_CI_UVM_META_CUR_INST               ((MuCommInst)0x25A)
+#define MU_CI_UVM_META_DUMP_KEEPALIVES        ((MuCommInst)0x25B)
+#define MU_CI_UVM_META_SNAPSHOT_STACK         ((MuCommInst)0x265)
+#define MU_CI_UVM_META_POP_FRAMES_TO          ((MuCommInst)0x25C)
+#define MU_CI_UVM_META_PUSH_FRAME             ((MuCommInst)0x25D)
+#define MU_CI_UVM_META_ENABLE_WATCHPOINT      ((MuCommInst)0x25E)
+#define MU_CI_UVM_META_DISABLE_WATCHPOINT     ((MuCommInst)0x25F)
+#define MU_CI_UVM_META_SET_TRAP_HANDLER       ((MuCommInst)0x260)
 /// SCRIPT: GENERATED COMMINSTS END
 
 #ifdef __cplusplus
@@ -0,0 +1,460 @@
+#!/usr/bin/env python3
+
+"""
+Generate a header-only C++ binding of the Mu client API from muapi.h.
+
+USAGE: python3 scripts/muapi2cpp.py < muapi.h > muapi.hpp
+
+The generated header includes muapi.h and defines the following in the
+namespace ``mu``:
+
+- One move-only class for each MuValue handle type, such as ``mu::IntValue``
+  for ``MuIntValue``. It holds the handle and the MuCtx it belongs to, and
+  deletes the handle when destroyed. The classes inherit from each other as the
+  typedefs in muapi.h do, so a ``mu::RefValue`` can be passed where a
+  ``mu::GenRefValue`` is expected.
+
+- One copyable class for each IR node type, such as ``mu::TypeNode``. IR nodes
+  are invalidated when their bundle is loaded or aborted, so these classes do
+  not own the handles.
+
+- ``mu::VM`` and ``mu::Ctx``, which wrap ``MuVM*`` and ``MuCtx*``. They have one
+  inline member function for each function pointer in the struct, with the same
+  name and the same parameters except the first. When compiled as C++20 or
+  later, functions with ``array`` pragmas also have overloads taking
+  ``std::span`` instead of each pointer and length pair. Arrays sharing one
+  length are checked with ``assert`` to have the same size. In these overloads,
+  arrays of MuValue handles are spans of the handle classes: input handles are
+  passed as ``std::span<const mu::Value>`` and the like, and output handles are
+  written into ``std::span<mu::Value>`` and the like, each owning its handle.
+  The overloads without spans pass raw handles, which the caller must delete.
+
+- ``mu::HandleScope``, which calls ``push_handle_scope`` when constructed and
+  ``pop_handle_scope`` when destroyed. ``mu::Ctx`` does not wrap these two
+  functions.
+
+Each member function only calls the function pointer and wraps the result.
+With optimisation, the only code beyond the equivalent C calls is the test in
+the destructor of a handle class of whether its handle has been moved out, and
+the copy of handles between the handle classes and a temporary array in the
+span overloads which take handle arrays.
+
+The function pointers are not cached. ``MuCtx`` and ``MuVM`` are already the
+function tables, so each call loads one pointer from the struct, as the
+equivalent C call does. Copying the table into each ``mu::Ctx`` would make it
+hundreds of bytes large and would not save that load.
+"""
+
+import sys
+
+import muapiparser
+
+_cpp_keywords = {
+        "auto", "bool", "catch", "class", "default", "delete", "explicit",
+        "export", "false", "friend", "mutable", "namespace", "new", "operator",
+        "private", "protected", "public", "register", "template", "this",
+        "throw", "true", "try", "typename", "union", "using", "virtual",
+        }
+
+# Functions not wrapped. The handle classes delete their own values, and
+# mu::HandleScope pushes and pops handle scopes.
+_skipped_methods = {"delete_value", "push_handle_scope", "pop_handle_scope"}
+
+def type_chain(typedefs, name):
+    chain = [name]
+    while name in typedefs:
+        name = typedefs[name]
+        chain.append(name)
+    return chain
+
+def cpp_name(c_name):
+    assert c_name.startswith("Mu")
+    return c_name[2:]
+
+def param_name(name):
+    return name + "_" if name in _cpp_keywords else name
+
+class Binding(object):
+    def __init__(self, ast):
+        self.ast = ast
+        typedefs = ast["typedefs"]
+
+        # Classify the handle types. Node types are checked first because
+        # MuIRNodeRefValue is also a subtype of MuValue.
+        self.value_types = []
+        self.node_types = []
+        for name in typedefs:
+            chain = type_chain(typedefs, name)
+            if "MuIRNodeRefValue" in chain:
+                self.node_types.append(name)
+            elif "MuValue" in chain:
+                self.value_types.append(name)
+
+        # Parents must be defined before their children.
+        depth = lambda n: len(type_chain(typedefs, n))
+        self.value_types.sort(key=depth)
+        self.node_types.sort(key=depth)
+        self.typedefs = typedefs
+
+    def parent_of(self, name):
+        parent = self.typedefs[name]
+        family = self.node_types if name in self.node_types else self.value_types
+        if parent in family:
+            return parent
+        return None
+
+    def gen_value_class(self, name):
+        cls = cpp_name(name)
+        parent = self.parent_of(name)
+        if parent is None:
+            return """\
+class {cls} {{
+public:
+    {cls}() noexcept = default;
+    explicit {cls}(MuCtx *ctx, {name} raw) noexcept : ctx_(ctx), raw_(raw) {{}}
+    {cls}({cls} &&other) noexcept : ctx_(other.ctx_), raw_(other.release()) {{}}
+    {cls} &operator=({cls} &&other) noexcept {{
+        if (this != &other) {{
+            reset();
+            ctx_ = other.ctx_;
+            raw_ = other.release();
+        }}
+        return *this;
+    }}
+    {cls}(const {cls} &) = delete;
+    {cls} &operator=(const {cls} &) = delete;
+    ~{cls}() {{ reset(); }}
+
+    MuCtx *ctx() const noexcept {{ return ctx_; }}
+    {name} get() const noexcept {{ return raw_; }}
+    {name} release() noexcept {{ return std::exchange(raw_, nullptr); }}
+    void reset() noexcept {{
+        if (raw_ != nullptr) {{
+            ctx_->delete_value(ctx_, raw_);
+            raw_ = nullptr;
+        }}
+    }}
+    explicit operator bool() const noexcept {{ return raw_ != nullptr; }}
+
+protected:
+    MuCtx *ctx_ = nullptr;
+    {name} raw_ = nullptr;
+}};
+""".format(cls=cls, name=name)
+        else:
+            return """\
+class {cls} : public {pcls} {{
+public:
+    using {pcls}::{pcls};
+    {name} get() const noexcept {{ return raw_; }}
+    {name} release() noexcept {{ return std::exchange(raw_, nullptr); }}
+}};
+""".format(cls=cls, pcls=cpp_name(parent), name=name)
+
+    def gen_node_class(self, name):
+        cls = cpp_name(name)
+        parent = self.parent_of(name)
+        if parent is None:
+            return """\
+class {cls} {{
+public:
+    {cls}() noexcept = default;
+    explicit {cls}({name} raw) noexcept : raw_(raw) {{}}
+
+    {name} get() const noexcept {{ return raw_; }}
+    explicit operator bool() const noexcept {{ return raw_ != nullptr; }}
+
+protected:
+    {name} raw_ = nullptr;
+}};
+""".format(cls=cls, name=name)
+        else:
+            return """\
+class {cls} : public {pcls} {{
+public:
+    using {pcls}::{pcls};
+    {name} get() const noexcept {{ return raw_; }}
+}};
+""".format(cls=cls, pcls=cpp_name(parent), name=name)
+
+    def map_param(self, ty, name):
+        """
+        Return the C++ parameter declaration and the C argument expression.
+        """
+        pn = param_name(name)
+        if ty in self.value_types:
+            return "const {} &{}".format(cpp_name(ty), pn), pn + ".get()"
+        if ty in self.node_types:
+            return "{} {}".format(cpp_name(ty), pn), pn + ".get()"
+        if ty == "MuName":
+            return "const char *{}".format(pn), "const_cast<MuName>({})".format(pn)
+        return "{} {}".format(ty, pn), pn
+
+    def wrap_return(self, ty, expr, this_raw):
+        if ty in self.value_types:
+            return "{}({}, {})".format(cpp_name(ty), this_raw, expr)
+        if ty in self.node_types:
+            return "{}({})".format(cpp_name(ty), expr)
+        if ty == "MuCtx*":
+            return "Ctx({})".format(expr)
+        return expr
+
+    def ret_decl(self, ty):
+        if ty in self.value_types:
+            return "[[nodiscard]] " + cpp_name(ty)
+        if ty in self.node_types:
+            return cpp_name(ty)
+        if ty == "MuCtx*":
+            return "[[nodiscard]] Ctx"
+        return ty
+
+    def gen_method(self, meth, struct_name, use_spans):
+        params = meth["params"][1:]
+        arrays = {}     # array param -> size param
+        outs = set()
+        optionals = set()
+        for pragma in meth["pragmas"]:
+            parts = pragma.split(":")
+            if len(parts) == 3 and parts[1] == "array":
+                arrays[parts[0]] = parts[2]
+            elif len(parts) == 2 and parts[1] == "out":
+                outs.add(parts[0])
+            elif len(parts) == 2 and parts[1] == "optional":
+                optionals.add(parts[0])
+
+        # Arrays of Mu value handles, and output handle buffers whose length
+        # is not a parameter, such as the results of dump_keepalives.
+        handle_arrays = {p["name"] for p in params
+                if p["type"].endswith("*") and p["type"][:-1] in self.value_types
+                and (p["name"] in arrays or p["name"] in outs)}
+
+        if use_spans and len(arrays) == 0 and len(handle_arrays) == 0:
+            return None
+
+        sizes = {}      # size param -> first array param using it
+        for p in params:
+            if p["name"] in arrays:
+                sizes.setdefault(arrays[p["name"]], p["name"])
+        param_types = {p["name"]: p["type"] for p in params}
+
+        checks = []
+        pre = []
+        post = []
+        decls = []
+        args = []
+        for p in params:
+            ty, name = p["type"], p["name"]
+            pn = param_name(name)
+            if use_spans and name in handle_arrays:
+                elem = ty[:-1]
+                if name in outs:
+                    decls.append("std::span<{}> {}".format(cpp_name(elem), pn))
+                    pre.append("std::vector<{0}> {1}_raw({1}.size());".format(
+                            elem, pn))
+                    post.append("detail::own_handles(raw_, {0}_raw, {0});"
+                            .format(pn))
+                else:
+                    decls.append("std::span<const {}> {}".format(
+                            cpp_name(elem), pn))
+                    pre.append("std::vector<{0}> {1}_raw = detail::raw_handles<{0}>({1});"
+                            .format(elem, pn))
+                if name in optionals:
+                    args.append("{0}.empty() ? nullptr : {0}_raw.data()"
+                            .format(pn))
+                else:
+                    args.append("{}_raw.data()".format(pn))
+            elif use_spans and name in arrays:
+                assert ty.endswith("*")
+                elem = ty[:-1]
+                if name in outs:
+                    decls.append("std::span<{}> {}".format(elem, pn))
+                    args.append("{}.data()".format(pn))
+                else:
+                    decls.append("std::span<const {}> {}".format(elem, pn))
+                    args.append("const_cast<{}>({}.data())".format(ty, pn))
+            elif use_spans and name in sizes:
+                args.append("static_cast<{}>({}.size())".format(
+                        param_types[name], param_name(sizes[name])))
+            else:
+                decl, arg = self.map_param(ty, name)
+                decls.append(decl)
+                args.append(arg)
+
+            if use_spans and name in arrays and sizes[arrays[name]] != name:
+                fn = param_name(sizes[arrays[name]])
+                if name in optionals:
+                    checks.append("assert({0}.empty() || {0}.size() == {1}.size());"
+                            .format(pn, fn))
+                else:
+                    checks.append("assert({}.size() == {}.size());".format(pn, fn))
+
+        this_raw = "raw_"
+        call = "{0}->{1}({0}{2})".format(this_raw, meth["name"],
+                "".join(", " + a for a in args))
+        ret_ty = meth["ret_ty"]
+        if ret_ty == "void":
+            body = [call + ";"] + post
+        elif len(post) == 0:
+            body = ["return " + self.wrap_return(ret_ty, call, this_raw) + ";"]
+        else:
+            body = ["{} result = {};".format(ret_ty, call)] + post + [
+                    "return " + self.wrap_return(ret_ty, "result", this_raw) + ";"]
+
+        head = "    {} {}({})".format(self.ret_decl(ret_ty), meth["name"],
+                ", ".join(decls))
+        stmts = checks + pre + body
+        if len(stmts) == 1:
+            return "{} {{ {} }}".format(head, stmts[0])
+        return "{} {{\n{}\n    }}".format(head,
+                "\n".join("        " + l for l in stmts))
+
+    def gen_struct_class(self, struct, cls, c_ty):
+        lines = []
+        span_lines = []
+        for meth in struct["methods"]:
+            if meth["name"] in _skipped_methods:
+                continue
+            lines.append(self.gen_method(meth, struct["name"], False))
+            span = self.gen_method(meth, struct["name"], True)
+            if span is not None:
+                span_lines.append(span)
+
+        return """\
+class {cls} {{
+public:
+    {cls}() noexcept = default;
+    explicit {cls}({c_ty} *raw) noexcept : raw_(raw) {{}}
+
+    {c_ty} *get() const noexcept {{ return raw_; }}
+    explicit operator bool() const noexcept {{ return raw_ != nullptr; }}
+
+{methods}
+#if MU_CPP_HAS_SPAN
+{spans}
+#endif
+
+private:
+    {c_ty} *raw_ = nullptr;
+}};
+""".format(cls=cls, c_ty=c_ty, methods="\n".join(lines),
+        spans="\n".join(span_lines))
+
+    def generate(self):
+        structs = {s["name"]: s for s in self.ast["structs"]}
+        out = []
+        out.append("""\
+// Generated by scripts/muapi2cpp.py from muapi.h. DO NOT EDIT.
+//
+// Ownership rule: an object of a move-only handle class (such as mu::IntValue)
+// deletes its handle when destroyed, so it must be destroyed or released
+// before the handle becomes invalid. This happens when
+//
+// - the context it belongs to is closed,
+// - the handle scope (mu::HandleScope) it was created in is popped, or
+// - the trap handler that received the context returns.
+//
+// Use promote_value to keep a value beyond its handle scope, and release()
+// handles that the Mu micro VM will free by itself. Handles written into raw
+// arrays (MuValue* and the like) are not owned by any object. Use the span
+// overloads to receive them as handle objects.
+
+#ifndef __MUAPI_HPP__
+#define __MUAPI_HPP__
+
+#include <cassert>
+#include <utility>
+
+#if __cplusplus >= 202002L
+#include <span>
+#include <vector>
+#define MU_CPP_HAS_SPAN 1
+#else
+#define MU_CPP_HAS_SPAN 0
+#endif
+
+#include "muapi.h"
+
+namespace mu {
+
+class Ctx;
+
+// Handles to Mu values. Each object owns one handle.
+""")
+        for name in self.value_types:
+            out.append(self.gen_value_class(name))
+
+        out.append("""\
+// Cast an owning handle to another handle type, transferring the ownership.
+template<class To, class From>
+To value_cast(From &&from) noexcept {
+    MuCtx *ctx = from.ctx();
+    return To(ctx, from.release());
+}
+
+#if MU_CPP_HAS_SPAN
+namespace detail {
+
+// Copy the handles held by handle objects into an array for the C API.
+template<class Raw, class W>
+std::vector<Raw> raw_handles(std::span<const W> ws) {
+    std::vector<Raw> raws;
+    raws.reserve(ws.size());
+    for (const W &w : ws) {
+        raws.push_back(w.get());
+    }
+    return raws;
+}
+
+// Move the handles written by the C API into handle objects. Elements not
+// written are still NULL and leave the handle objects unchanged.
+template<class W, class Raw>
+void own_handles(MuCtx *ctx, const std::vector<Raw> &raws, std::span<W> ws) {
+    for (std::size_t i = 0; i < raws.size(); i++) {
+        if (raws[i] != nullptr) {
+            ws[i] = W(ctx, raws[i]);
+        }
+    }
+}
+
+} // namespace detail
+#endif
+
+// References to IR nodes. They do not own the handles.
+""")
+        for name in self.node_types:
+            out.append(self.gen_node_class(name))
+
+        out.append(self.gen_struct_class(structs["MuCtx"], "Ctx", "MuCtx"))
+        out.append(self.gen_struct_class(structs["MuVM"], "VM", "MuVM"))
+
+        out.append("""\
+// Pushes a handle scope on construction and pops it on destruction. Handle
+// objects created in the scope must be destroyed or released first.
+class HandleScope {
+public:
+    explicit HandleScope(MuCtx *ctx) : ctx_(ctx) {
+        ctx_->push_handle_scope(ctx_);
+    }
+    explicit HandleScope(const Ctx &ctx) : HandleScope(ctx.get()) {}
+    HandleScope(const HandleScope &) = delete;
+    HandleScope &operator=(const HandleScope &) = delete;
+    ~HandleScope() { ctx_->pop_handle_scope(ctx_); }
+
+private:
+    MuCtx *ctx_;
+};
+""")
+
+        out.append("""\
+} // namespace mu
+
+#undef MU_CPP_HAS_SPAN
+
+#endif // __MUAPI_HPP__
+""")
+        return "\n".join(out)
+
+if __name__ == '__main__':
+    text = sys.stdin.read()
+    ast = muapiparser.parse_muapi(text)
+    sys.stdout.write(Binding(ast).generate())
@@ -6,8 +6,6 @@ The result will be a simple JSON object (dict of dicts).
 
 import re
 
-import injecttools
-
 r_commpragma = re.compile(r'///\s*MUAPIPARSER:(.*)$')
 r_comment = re.compile(r'//.*$', re.MULTILINE)
 r_decl = re.compile(r'(?P<ret>\w+\s*\*?)\s*\(\s*\*\s*(?P<name>\w+)\s*\)\s*\((?P<params>[^)]*)\)\s*;\s*(?:///\s*MUAPIPARSER\s+(?P<pragma>.*)$)?', re.MULTILINE)
@@ -52,7 +50,20 @@ def extract_methods(body):
     return methods
 
 def extract_struct(text, name):
-    return injecttools.extract_lines(text, (r_struct_start, name), (r_struct_end,))
+    lines = text.splitlines()
+    for i, line in enumerate(lines):
+        m = r_struct_start.search(line)
+        if m is not None and m.group(1) == name:
+            break
+    else:
+        raise ValueError("Cannot find struct {}".format(name))
+
+    body = []
+    for line in lines[i+1:]:
+        if r_struct_end.search(line) is not None:
+            break
+        body.append(line)
+    return "\n".join(body)
 
 def extract_enums(text, typename, pattern):
     defs = []
@@ -68,15 +79,23 @@ def extract_enums(text, typename, pattern):
 
 _top_level_structs = ["MuVM", "MuCtx"]
 _enums = [(typename, re.compile(regex)) for typename, regex in [
-    ("MuTrapHandlerResult", r'^MU_(THREAD|REBIND)'),
+    ("MuTrapHandlerResult", r'^MU_(THREAD_EXIT|REBIND_|RESUME)'),
     ("MuDestKind",          r'^MU_DEST_'),
-    ("MuBinOptr",           r'^MU_BINOP_'),
+    ("MuBinOptr",           r'^MU_BINOP_(?!STATUS_)'),
+    ("MuBinOpStatus",       r'^MU_BINOP_STATUS_'),
     ("MuCmpOptr",           r'^MU_CMP_'),
     ("MuConvOptr",          r'^MU_CONV_'),
     ("MuMemOrd",            r'^MU_ORD_'),
     ("MuAtomicRMWOptr",     r'^MU_ARMW_'),
     ("MuCallConv",          r'^MU_CC_'),
     ("MuCommInst",          r'^MU_CI_'),
+    ("MuAllocStat",         r'^MU_ALLOC_STAT_'),
+    ("MuMapMode",           r'^MU_MAP_'),
+    ("MuHeapStat",          r'^MU_HEAP_STAT_'),
+    ("MuGCKind",            r'^MU_GC_'),
+    ("MuLargeAllocFlags",   r'^MU_LARGE_ALLOC_'),
+    ("MuPerfMapFlags",      r'^MU_PERF_'),
+    ("MuIRStreamOp",        r'^MU_IRS_'),
     ]]
 
 def extract_typedefs(text):